@@ -10,6 +10,12 @@
 #include <iterator>
 #include <type_traits>
 #include <cstring>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
 
 #define ERROR(msg)  throw std::runtime_error(msg);
 
@@ -17,6 +23,12 @@
 #define ElementStart    0x0A
 #define ElementEnd      0x0B
 
+#define ContainerMagic      0x434C4258  // "XBLC" little-endian
+#define ContainerVersion    0x01
+#define ContainerChunkSize  (64 * 1024)
+
+#define TapeNone        0xFFFFFFFF
+
 
 
 namespace xbl {
@@ -78,12 +90,16 @@ namespace xbl {
         Element& operator[](const std::string& elementName);
     };
 
+    struct Tape;
+
     struct Parser {
         uint8_t nextByte(size_t& i, const std::vector<uint8_t>& data);
         std::string parseStandardString(size_t& i, const std::vector<uint8_t>& data);
         DateTime parseDateTime(const std::string& stringDateTime);
         xbl::Attribute parseStandardAttribute(const std::string& name, uint8_t typeByte, std::string value);
         Document parse(const std::vector<uint8_t>& data);
+        Document parseCompressed(const std::vector<uint8_t>& data, unsigned threadCount = 0);
+        Tape parseTape(const std::vector<uint8_t>& data);
 
         std::vector<uint8_t> readBinary(const std::string& path);
     };
@@ -98,6 +114,99 @@ namespace xbl {
         std::vector<uint8_t> serializeAttribute(const Attribute& at);
         std::vector<uint8_t> serializeElement(const Element& el);
         std::vector<uint8_t> serialize(const Document& doc);
+        std::vector<uint8_t> serializeCompressed(const Document& doc, size_t chunkSize = ContainerChunkSize);
+    };
+
+    // Fixed-size element record, stored in pre-order
+    struct TapeNode {
+        uint32_t name;              // symbol id
+        uint32_t attributeBegin;    // range in Tape::attributes
+        uint32_t attributeEnd;
+        uint32_t firstChild;        // node index or TapeNone
+        uint32_t nextSibling;       // node index or TapeNone
+        uint32_t subtreeEnd;        // one past the last descendant
+    };
+
+    struct TapeAttribute {
+        uint64_t    bits;           // scalar payload, strings are (offset << 32 | length) into Tape::strings
+        uint32_t    name;           // symbol id
+        ValueType   type;
+    };
+
+    struct Tape {
+        // Follows `nextSibling` links, yields node indices
+        struct SiblingIterator {
+            const Tape* tape;
+            uint32_t    index;
+
+            uint32_t operator*() const { return index; }
+            SiblingIterator& operator++() { index = tape->nodes[index].nextSibling; return *this; }
+            bool operator!=(const SiblingIterator& other) const { return index != other.index; }
+            bool operator==(const SiblingIterator& other) const { return index == other.index; }
+        };
+
+        struct SiblingRange {
+            SiblingIterator first;
+            SiblingIterator last;
+            SiblingIterator begin() const { return first; }
+            SiblingIterator end() const { return last; }
+        };
+
+        // Contiguous run of nodes (a depth-first walk)
+        struct NodeRange {
+            const TapeNode* first;
+            const TapeNode* last;
+            const TapeNode* begin() const { return first; }
+            const TapeNode* end() const { return last; }
+            size_t size() const { return last - first; }
+        };
+
+        struct AttributeRange {
+            const TapeAttribute* first;
+            const TapeAttribute* last;
+            const TapeAttribute* begin() const { return first; }
+            const TapeAttribute* end() const { return last; }
+            size_t size() const { return last - first; }
+        };
+
+        std::vector<TapeNode>       nodes;          // pre-order
+        std::vector<TapeAttribute>  attributes;     // packed, grouped per node
+        std::vector<uint64_t>       symbols;        // (offset << 32 | length) into strings
+        std::string                 strings;        // names and string values
+
+        const TapeNode* begin() const;
+        const TapeNode* end() const;
+        uint32_t indexOf(const TapeNode& node) const;
+        NodeRange subtree(uint32_t node) const;
+        SiblingRange roots() const;
+        SiblingRange children(uint32_t node) const;
+        AttributeRange attributesOf(uint32_t node) const;
+
+        std::string_view symbol(uint32_t id) const;
+        std::string_view name(uint32_t node) const;
+        std::string_view string(const TapeAttribute& at) const;
+        Value value(const TapeAttribute& at) const;
+        const TapeAttribute& attribute(uint32_t node, const std::string& name) const;
+        uint32_t child(uint32_t node, const std::string& childName) const;
+        uint32_t root(const std::string& elementName) const;
+
+        static Tape fromDocument(const Document& doc);
+        Document toDocument() const;
+    };
+
+    struct ChunkEntry {
+        uint32_t offset;            // relative to the end of the chunk directory
+        uint32_t compressedSize;
+        uint32_t rawSize;
+        uint32_t checksum;          // Adler-32 of the raw chunk
+    };
+
+    struct Codec {
+        void writeU32(std::vector<uint8_t>& out, uint32_t x);
+        uint32_t readU32(size_t& i, const std::vector<uint8_t>& data);
+        uint32_t checksum(const uint8_t* data, size_t size);
+        std::vector<uint8_t> compress(const std::vector<uint8_t>& data);
+        std::vector<uint8_t> decompress(const uint8_t* data, size_t size, size_t rawSize);
     };
 
     
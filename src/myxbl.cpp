@@ -113,6 +113,394 @@ xbl::Element& xbl::Document::operator[](const std::string& elementName) {
     ERROR("Element not found: " + elementName);
 }
 
+//==========
+// TAPE
+//==========
+
+namespace {
+
+    uint64_t packDateTime(const xbl::DateTime& dt) {
+        return ((uint64_t)dt.year << 40) | ((uint64_t)dt.month << 32) | ((uint64_t)dt.day << 24)
+             | ((uint64_t)dt.hour << 16) | ((uint64_t)dt.minute << 8) | (uint64_t)dt.second;
+    }
+
+    xbl::DateTime unpackDateTime(uint64_t bits) {
+        xbl::DateTime dt;
+        dt.year =   static_cast<uint16_t>(bits >> 40);
+        dt.month =  static_cast<uint8_t>(bits >> 32);
+        dt.day =    static_cast<uint8_t>(bits >> 24);
+        dt.hour =   static_cast<uint8_t>(bits >> 16);
+        dt.minute = static_cast<uint8_t>(bits >> 8);
+        dt.second = static_cast<uint8_t>(bits);
+        return dt;
+    }
+
+    // Appends nodes in pre-order and keeps the child/sibling links up to date
+    struct TapeWriter {
+        struct Frame {
+            uint32_t node;
+            uint32_t lastChild;
+        };
+
+        xbl::Tape& tape;
+        std::unordered_map<std::string_view, uint32_t> symbolIndex; // keys view the source, not tape.strings
+        std::vector<Frame> stack;
+        uint32_t lastRoot = TapeNone;
+
+        explicit TapeWriter(xbl::Tape& t) : tape(t) {}
+
+        uint64_t addString(std::string_view s) {
+            if(tape.strings.size() + s.size() > UINT32_MAX) ERROR("Tape string table too large");
+            uint64_t packed = ((uint64_t)tape.strings.size() << 32) | s.size();
+            tape.strings.append(s);
+            return packed;
+        }
+
+        uint32_t intern(std::string_view s) {
+            auto it = symbolIndex.find(s);
+            if(it != symbolIndex.end()) return it->second;
+            uint32_t id = static_cast<uint32_t>(tape.symbols.size());
+            tape.symbols.push_back(addString(s));
+            symbolIndex.emplace(s, id);
+            return id;
+        }
+
+        uint64_t packValue(const xbl::Value& v) {
+            switch (v.type) {
+                case xbl::ValueType::String:   return addString(std::get<std::string>(v.data));
+                case xbl::ValueType::Int32:    return static_cast<uint32_t>(std::get<int32_t>(v.data));
+                case xbl::ValueType::UInt32:   return std::get<uint32_t>(v.data);
+                case xbl::ValueType::Int64:    return static_cast<uint64_t>(std::get<int64_t>(v.data));
+                case xbl::ValueType::UInt64:   return std::get<uint64_t>(v.data);
+                case xbl::ValueType::Float32: {
+                    uint32_t u;
+                    std::memcpy(&u, &std::get<float>(v.data), 4);
+                    return u;
+                }
+                case xbl::ValueType::Float64: {
+                    uint64_t u;
+                    std::memcpy(&u, &std::get<double>(v.data), 8);
+                    return u;
+                }
+                case xbl::ValueType::UInt8:    return std::get<uint8_t>(v.data);
+                case xbl::ValueType::DateTime: return packDateTime(std::get<xbl::DateTime>(v.data));
+                default:
+                    ERROR("Invalid data type: " + std::to_string((int)v.type));
+            }
+        }
+
+        // Packs the serialized bytes of a value, scalars are little-endian
+        uint64_t packBytes(xbl::ValueType type, std::string_view value, xbl::Parser& parser) {
+            size_t expected = 0;
+            switch (type) {
+                case xbl::ValueType::String:   return addString(value);
+                case xbl::ValueType::DateTime: return packDateTime(parser.parseDateTime(std::string(value)));
+                case xbl::ValueType::Int32:
+                case xbl::ValueType::UInt32:
+                case xbl::ValueType::Float32:  expected = 4; break;
+                case xbl::ValueType::Int64:
+                case xbl::ValueType::UInt64:
+                case xbl::ValueType::Float64:  expected = 8; break;
+                case xbl::ValueType::UInt8:    expected = 1; break;
+                default:
+                    ERROR("Invalid data type: " + std::to_string((int)type));
+            }
+            if(value.size() != expected)
+                ERROR("Invalid value size: " + std::to_string(value.size()));
+
+            uint64_t u = 0;
+            for (size_t i = 0; i < expected; ++i)
+                u |= (uint64_t)(uint8_t)value[i] << (8 * i);
+            return u;
+        }
+
+        void addAttribute(const xbl::TapeAttribute& at) {
+            if(tape.attributes.size() >= TapeNone) ERROR("Too many attributes for tape");
+            tape.attributes.push_back(at);
+        }
+
+        // Attributes of the node must already be in tape.attributes[attributeBegin..]
+        void openNode(uint32_t name, uint32_t attributeBegin) {
+            if(tape.nodes.size() >= TapeNone) ERROR("Too many nodes for tape");
+            uint32_t index = static_cast<uint32_t>(tape.nodes.size());
+
+            xbl::TapeNode node;
+            node.name = name;
+            node.attributeBegin = attributeBegin;
+            node.attributeEnd = static_cast<uint32_t>(tape.attributes.size());
+            node.firstChild = TapeNone;
+            node.nextSibling = TapeNone;
+            node.subtreeEnd = index + 1;
+            tape.nodes.push_back(node);
+
+            uint32_t& previous = stack.empty() ? lastRoot : stack.back().lastChild;
+            if(previous != TapeNone) tape.nodes[previous].nextSibling = index;
+            else if(!stack.empty()) tape.nodes[stack.back().node].firstChild = index;
+            previous = index;
+
+            stack.push_back({index, TapeNone});
+        }
+
+        void closeNode() {
+            if(stack.empty()) ERROR("Unexpected element end");
+            tape.nodes[stack.back().node].subtreeEnd = static_cast<uint32_t>(tape.nodes.size());
+            stack.pop_back();
+        }
+
+        void finish() {
+            if(!stack.empty()) ERROR("Incomplete elements present");
+        }
+
+        void addElement(const xbl::Element& el) {
+            uint32_t attributeBegin = static_cast<uint32_t>(tape.attributes.size());
+            for(const auto& attribute : el.attributes) {
+                xbl::TapeAttribute at;
+                at.name = intern(attribute.name);
+                at.type = attribute.value.type;
+                at.bits = packValue(attribute.value);
+                addAttribute(at);
+            }
+            openNode(intern(el.name), attributeBegin);
+            for(const auto& child : el.children) {
+                addElement(*child);
+            }
+            closeNode();
+        }
+    };
+
+} // namespace
+
+/**
+ * Returns the first node of a depth-first (pre-order) walk
+ * @param None
+ * @returns Pointer to the first node
+ * @throws None
+ */
+const xbl::TapeNode* xbl::Tape::begin() const {
+    return nodes.data();
+}
+
+/**
+ * Returns one past the last node of a depth-first (pre-order) walk
+ * @param None
+ * @returns Pointer past the last node
+ * @throws None
+ */
+const xbl::TapeNode* xbl::Tape::end() const {
+    return nodes.data() + nodes.size();
+}
+
+/**
+ * Returns the index of a node stored in this tape
+ * @param node Reference to a node inside `nodes`
+ * @returns Node index
+ * @throws None
+ */
+uint32_t xbl::Tape::indexOf(const TapeNode& node) const {
+    return static_cast<uint32_t>(&node - nodes.data());
+}
+
+/**
+ * Returns a node and all of its descendants in depth-first order
+ * @param node Node index
+ * @returns Range of nodes
+ * @throws None
+ */
+xbl::Tape::NodeRange xbl::Tape::subtree(uint32_t node) const {
+    return {nodes.data() + node, nodes.data() + nodes[node].subtreeEnd};
+}
+
+/**
+ * Returns the root elements
+ * @param None
+ * @returns Range of root node indices
+ * @throws None
+ */
+xbl::Tape::SiblingRange xbl::Tape::roots() const {
+    return {{this, nodes.empty() ? TapeNone : 0}, {this, TapeNone}};
+}
+
+/**
+ * Returns the direct children of a node
+ * @param node Node index
+ * @returns Range of child node indices
+ * @throws None
+ */
+xbl::Tape::SiblingRange xbl::Tape::children(uint32_t node) const {
+    return {{this, nodes[node].firstChild}, {this, TapeNone}};
+}
+
+/**
+ * Returns the attributes of a node
+ * @param node Node index
+ * @returns Range of attributes
+ * @throws None
+ */
+xbl::Tape::AttributeRange xbl::Tape::attributesOf(uint32_t node) const {
+    return {attributes.data() + nodes[node].attributeBegin, attributes.data() + nodes[node].attributeEnd};
+}
+
+/**
+ * Returns the text of a symbol
+ * @param id Symbol id
+ * @returns View into the string table
+ * @throws None
+ */
+std::string_view xbl::Tape::symbol(uint32_t id) const {
+    uint64_t packed = symbols[id];
+    return std::string_view(strings).substr(packed >> 32, packed & 0xFFFFFFFF);
+}
+
+/**
+ * Returns the name of a node
+ * @param node Node index
+ * @returns View into the string table
+ * @throws None
+ */
+std::string_view xbl::Tape::name(uint32_t node) const {
+    return symbol(nodes[node].name);
+}
+
+/**
+ * Returns the value of a String attribute
+ * @param at Attribute of this tape
+ * @returns View into the string table
+ * @throws std::runtime_error If the attribute is not a String
+ */
+std::string_view xbl::Tape::string(const TapeAttribute& at) const {
+    if(at.type != ValueType::String) ERROR("Attribute is not a string");
+    return std::string_view(strings).substr(at.bits >> 32, at.bits & 0xFFFFFFFF);
+}
+
+/**
+ * Unpacks an attribute into a Value object
+ * @param at Attribute of this tape
+ * @returns Value object
+ * @throws std::runtime_error If the value type is invalid
+ */
+xbl::Value xbl::Tape::value(const TapeAttribute& at) const {
+    xbl::Value result;
+    result.type = at.type;
+
+    switch (at.type) {
+        case xbl::ValueType::String:   result.data = std::string(string(at)); break;
+        case xbl::ValueType::Int32:    result.data = static_cast<int32_t>(static_cast<uint32_t>(at.bits)); break;
+        case xbl::ValueType::UInt32:   result.data = static_cast<uint32_t>(at.bits); break;
+        case xbl::ValueType::Int64:    result.data = static_cast<int64_t>(at.bits); break;
+        case xbl::ValueType::UInt64:   result.data = at.bits; break;
+        case xbl::ValueType::Float32: {
+            uint32_t u = static_cast<uint32_t>(at.bits);
+            float f;
+            std::memcpy(&f, &u, 4);
+            result.data = f;
+            break;
+        }
+        case xbl::ValueType::Float64: {
+            double d;
+            std::memcpy(&d, &at.bits, 8);
+            result.data = d;
+            break;
+        }
+        case xbl::ValueType::UInt8:    result.data = static_cast<uint8_t>(at.bits); break;
+        case xbl::ValueType::DateTime: result.data = unpackDateTime(at.bits); break;
+        default:
+            ERROR("Invalid data type: " + std::to_string((int)at.type));
+    }
+    return result;
+}
+
+/**
+ * Returns attribute of a node by name of `name`
+ * @param node Node index
+ * @param name Name of attribute
+ * @returns Reference to attribute
+ * @throws std::runtime_error If node does not have an attribute by name of `name`
+ */
+const xbl::TapeAttribute& xbl::Tape::attribute(uint32_t node, const std::string& name) const {
+    for(const auto& at : attributesOf(node)) {
+        if(symbol(at.name) == name) return at;
+    }
+    ERROR("Element does not have attribute: " + name);
+}
+
+/**
+ * Returns the child node by name of `childName`
+ * @param node Node index
+ * @param childName Name of child element
+ * @returns Index of child node
+ * @throws std::runtime_error If child element is not found
+ */
+uint32_t xbl::Tape::child(uint32_t node, const std::string& childName) const {
+    for(uint32_t c : children(node)) {
+        if(name(c) == childName) return c;
+    }
+    ERROR("Child element not found: " + childName);
+}
+
+/**
+ * Returns the root node by name of `elementName`
+ * @param elementName Name of root element
+ * @returns Index of root node
+ * @throws std::runtime_error If `elementName` is not a root element
+ */
+uint32_t xbl::Tape::root(const std::string& elementName) const {
+    for(uint32_t r : roots()) {
+        if(name(r) == elementName) return r;
+    }
+    ERROR("Element not found: " + elementName);
+}
+
+/**
+ * Flattens a Document object into a Tape
+ * @param doc Document
+ * @returns Tape
+ * @throws std::runtime_error If the document exceeds the 32-bit tape indices
+ */
+xbl::Tape xbl::Tape::fromDocument(const Document& doc) {
+    xbl::Tape result;
+    TapeWriter writer(result);
+    for(const auto& root : doc.elements) {
+        writer.addElement(*root);
+    }
+    writer.finish();
+    return result;
+}
+
+/**
+ * Rebuilds a Document object from the tape
+ * @param None
+ * @returns Document
+ * @throws None
+ */
+xbl::Document xbl::Tape::toDocument() const {
+    xbl::Document result;
+    std::vector<xbl::Element*> stack; // element of each open node
+    std::vector<uint32_t> ends;       // subtreeEnd of each open node
+
+    for(uint32_t i = 0; i < nodes.size(); i++) {
+        while(!ends.empty() && ends.back() <= i) {
+            stack.pop_back();
+            ends.pop_back();
+        }
+
+        std::string elementName(name(i));
+        xbl::Element& el = stack.empty() ? result.createElement(elementName) : stack.back()->createChild(elementName);
+        el.parent = stack.empty() ? nullptr : stack.back();
+        el.attributes.reserve(nodes[i].attributeEnd - nodes[i].attributeBegin);
+        for(const auto& at : attributesOf(i)) {
+            el.addAttribute(std::string(symbol(at.name)), value(at));
+        }
+
+        stack.push_back(&el);
+        ends.push_back(nodes[i].subtreeEnd);
+    }
+    return result;
+}
+
+//==========
+// PARSER
+//==========
+
 /**
  * Advances index to the next byte and returns the new byte
  * @param i Reference to the index
@@ -362,6 +750,147 @@ xbl::Document xbl::Parser::parse(const std::vector<uint8_t>& data) {
     return result;
 }
 
+/**
+ * Parses a chunked, block-compressed container into a Document object.
+ * Each chunk holds whole root elements, so worker threads decompress and
+ * parse chunks independently; the root elements are then joined in order.
+ * @param data Binary bytes of the container (see Serializer::serializeCompressed)
+ * @param threadCount Number of worker threads, 0 uses the hardware concurrency
+ * @returns Deserialized Document object containing file data and structure
+ * @throws std::runtime_error If the header or chunk directory is invalid
+ * @throws std::runtime_error If a chunk fails to decompress or its checksum does not match
+ * @throws std::runtime_error If a chunk contains invalid XBL data
+ * @throws std::system_error If a worker thread cannot be started
+ */
+xbl::Document xbl::Parser::parseCompressed(const std::vector<uint8_t>& data, unsigned threadCount) {
+    xbl::Codec codec;
+
+    // Header
+    size_t i = 0;
+    if(codec.readU32(i, data) != ContainerMagic) ERROR("Not an XBL container");
+    uint8_t version = nextByte(i, data);
+    if(version != ContainerVersion) ERROR("Unsupported container version: " + std::to_string((int)version));
+    uint32_t chunkCount = codec.readU32(i, data);
+
+    // Chunk directory
+    if(chunkCount > (data.size() - i) / 16) ERROR("Chunk directory exceeds container size");
+    std::vector<xbl::ChunkEntry> directory(chunkCount);
+    for(auto& entry : directory) {
+        entry.offset = codec.readU32(i, data);
+        entry.compressedSize = codec.readU32(i, data);
+        entry.rawSize = codec.readU32(i, data);
+        entry.checksum = codec.readU32(i, data);
+    }
+    const uint8_t* payload = data.data() + i;
+    const size_t payloadSize = data.size() - i;
+    for(const auto& entry : directory) {
+        if((uint64_t)entry.offset + entry.compressedSize > payloadSize)
+            ERROR("Chunk exceeds container size");
+    }
+
+    // Decompress and parse chunks in parallel
+    std::vector<xbl::Document> parts(chunkCount);
+    std::vector<std::exception_ptr> errors(chunkCount);
+    std::atomic<uint32_t> next{0};
+
+    auto worker = [&]() {
+        xbl::Codec localCodec;
+        xbl::Parser localParser;
+        for(uint32_t k = next++; k < chunkCount; k = next++) {
+            try {
+                const xbl::ChunkEntry& entry = directory[k];
+                std::vector<uint8_t> raw = localCodec.decompress(payload + entry.offset, entry.compressedSize, entry.rawSize);
+                if(localCodec.checksum(raw.data(), raw.size()) != entry.checksum)
+                    ERROR("Checksum mismatch in chunk: " + std::to_string(k));
+                parts[k] = localParser.parse(raw);
+            } catch(...) {
+                errors[k] = std::current_exception();
+            }
+        }
+    };
+
+    if(threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min<unsigned>(threadCount, chunkCount);
+
+    std::vector<std::thread> threads;
+    try {
+        for(unsigned t = 1; t < threadCount; t++) threads.emplace_back(worker);
+    } catch(...) {
+        next = chunkCount; // stop handing out chunks
+        for(auto& thread : threads) thread.join();
+        throw;
+    }
+    worker();
+    for(auto& thread : threads) thread.join();
+
+    // Join root elements in chunk order
+    xbl::Document result;
+    for(uint32_t k = 0; k < chunkCount; k++) {
+        if(errors[k]) std::rethrow_exception(errors[k]);
+        for(auto& root : parts[k].elements) {
+            result.elements.push_back(std::move(root));
+        }
+    }
+    return result;
+}
+
+/**
+ * Parses (deserializes) binary data straight into a flat Tape, without
+ * building the Element tree
+ * @param data Binary bytes of the XBL file
+ * @returns Tape containing file data and structure
+ * @throws std::runtime_error If an invalid byte is read
+ * @throws std::runtime_error If an attribute value has the wrong size for its type
+ * @throws std::runtime_error If elements are not closed (missing ElementEnd)
+ */
+xbl::Tape xbl::Parser::parseTape(const std::vector<uint8_t>& data) {
+    xbl::Tape result;
+    TapeWriter writer(result);
+
+    auto readView = [&](size_t& i) {
+        uint8_t length = nextByte(i, data);
+        if (i + length > data.size())
+            ERROR("Unexpected EOF while reading string");
+        std::string_view view(reinterpret_cast<const char*>(&data[i]), length);
+        i += length;
+        return view;
+    };
+
+    for(size_t i = 0; i < data.size();) {
+        uint8_t byte = data[i];
+
+        // Element Start
+        if(byte == ElementStart) {
+            ++i;
+            std::string_view name = readView(i);
+            uint8_t attributeCount = nextByte(i, data);
+            uint32_t attributeBegin = static_cast<uint32_t>(result.attributes.size());
+            for(size_t j = 0; j < attributeCount; j++) {
+                xbl::TapeAttribute at;
+                at.name = writer.intern(readView(i));
+                at.type = static_cast<xbl::ValueType>(nextByte(i, data));
+                std::string_view value = readView(i);
+                at.bits = writer.packBytes(at.type, value, *this);
+                writer.addAttribute(at);
+            }
+            writer.openNode(writer.intern(name), attributeBegin);
+            continue;
+        }
+        // Element End
+        if(byte == ElementEnd) {
+            writer.closeNode();
+            ++i;
+            continue;
+        }
+
+        // Invalid byte
+        ERROR(std::string("Unrecognized byte: ") + std::to_string((int)byte));
+    }
+
+    writer.finish();
+    return result;
+}
+
 /**
  * Reads binary file
  * @param path Path to the file that is read
@@ -578,3 +1107,249 @@ std::vector<uint8_t> xbl::Serializer::serialize(const Document& doc) {
     }
     return result;
 }
+
+/**
+ * Serializes document object into a chunked, block-compressed container.
+ * Root elements are grouped into chunks of roughly `chunkSize` raw bytes,
+ * every chunk is compressed independently and listed in a chunk directory.
+ *
+ * Layout (little-endian):
+ *   magic (u32) | version (u8) | chunk count (u32)
+ *   chunk count x { offset (u32), compressed size (u32), raw size (u32), checksum (u32) }
+ *   compressed chunks
+ *
+ * @param doc Document
+ * @param chunkSize Raw size at which a chunk is closed
+ * @returns Vector of bytes
+ * @throws std::runtime_error If a chunk or the container exceeds 4 GiB
+ */
+std::vector<uint8_t> xbl::Serializer::serializeCompressed(const Document& doc, size_t chunkSize) {
+    xbl::Codec codec;
+    std::vector<xbl::ChunkEntry> directory;
+    std::vector<uint8_t> payload;
+    std::vector<uint8_t> raw;
+
+    auto flush = [&]() {
+        if(raw.empty()) return;
+        if(raw.size() > UINT32_MAX) ERROR("Chunk too large with size: " + std::to_string(raw.size()));
+        std::vector<uint8_t> compressed = codec.compress(raw);
+        if(payload.size() + compressed.size() > UINT32_MAX) ERROR("Container too large");
+
+        xbl::ChunkEntry entry;
+        entry.offset = static_cast<uint32_t>(payload.size());
+        entry.compressedSize = static_cast<uint32_t>(compressed.size());
+        entry.rawSize = static_cast<uint32_t>(raw.size());
+        entry.checksum = codec.checksum(raw.data(), raw.size());
+        directory.push_back(entry);
+
+        payload.insert(payload.end(), compressed.begin(), compressed.end());
+        raw.clear();
+    };
+
+    // Split on root element boundaries
+    for(const auto& root : doc.elements) {
+        auto rootElementSerialized = serializeElement(*root);
+        raw.insert(raw.end(), rootElementSerialized.begin(), rootElementSerialized.end());
+        if(raw.size() >= chunkSize) flush();
+    }
+    flush();
+
+    std::vector<uint8_t> result;
+    codec.writeU32(result, ContainerMagic);
+    result.push_back(ContainerVersion);
+    codec.writeU32(result, static_cast<uint32_t>(directory.size()));
+    for(const auto& entry : directory) {
+        codec.writeU32(result, entry.offset);
+        codec.writeU32(result, entry.compressedSize);
+        codec.writeU32(result, entry.rawSize);
+        codec.writeU32(result, entry.checksum);
+    }
+    result.insert(result.end(), payload.begin(), payload.end());
+    return result;
+}
+
+//==========
+// CODEC
+//==========
+
+/*
+    LZ-style block format, one sequence after another
+    Token byte: high nibble literal length, low nibble match length - 4
+    A nibble of 15 is followed by extra length bytes (255 means keep reading)
+    Literals
+    Match offset (u16, little-endian), omitted after the last literals
+*/
+
+/**
+ * Appends a little-endian 32-bit integer
+ * @param out Vector the bytes are appended to
+ * @param x Integer to be written
+ * @returns None
+ * @throws None
+ */
+void xbl::Codec::writeU32(std::vector<uint8_t>& out, uint32_t x) {
+    for (size_t i = 0; i < sizeof(uint32_t); ++i) {
+        out.push_back(static_cast<uint8_t>((x >> (8 * i)) & 0xFF));
+    }
+}
+
+/**
+ * Reads a little-endian 32-bit integer and advances the index past it
+ * @param i Reference to the index
+ * @param data Vector containing the bytes
+ * @returns Integer read
+ * @throws std::runtime_error If fewer than 4 bytes remain
+ */
+uint32_t xbl::Codec::readU32(size_t& i, const std::vector<uint8_t>& data) {
+    if(i > data.size() || data.size() - i < 4) ERROR("Unexpected EOF while reading u32");
+    uint32_t u = 0;
+    for (size_t j = 0; j < 4; ++j)
+        u |= (uint32_t)data[i + j] << (8 * j);
+    i += 4;
+    return u;
+}
+
+/**
+ * Computes the Adler-32 checksum of a block
+ * @param data Pointer to the bytes
+ * @param size Number of bytes
+ * @returns Checksum
+ * @throws None
+ */
+uint32_t xbl::Codec::checksum(const uint8_t* data, size_t size) {
+    const uint32_t mod = 65521;
+    uint32_t a = 1, b = 0;
+    while(size > 0) {
+        size_t block = std::min<size_t>(size, 5552); // largest block without overflow
+        size -= block;
+        while(block--) {
+            a += *data++;
+            b += a;
+        }
+        a %= mod;
+        b %= mod;
+    }
+    return (b << 16) | a;
+}
+
+/**
+ * Compresses a block with the built-in LZ codec
+ * @param data Raw bytes
+ * @returns Compressed bytes
+ * @throws None
+ */
+std::vector<uint8_t> xbl::Codec::compress(const std::vector<uint8_t>& data) {
+    const size_t minMatch = 4;
+    const size_t maxOffset = 0xFFFF;
+    const size_t size = data.size();
+
+    std::vector<uint8_t> result;
+    result.reserve(size / 2 + 16);
+    std::vector<uint32_t> table(1 << 14, 0); // position + 1 of the last 4-byte sequence per hash
+
+    auto read32 = [&](size_t p) {
+        uint32_t u;
+        std::memcpy(&u, &data[p], 4);
+        return u;
+    };
+    auto writeLength = [&](size_t length) {
+        for(; length >= 255; length -= 255) result.push_back(255);
+        result.push_back(static_cast<uint8_t>(length));
+    };
+    auto writeLiterals = [&](size_t anchor, size_t literalLength, uint8_t matchNibble) {
+        result.push_back(static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | matchNibble));
+        if(literalLength >= 15) writeLength(literalLength - 15);
+        result.insert(result.end(), data.begin() + anchor, data.begin() + anchor + literalLength);
+    };
+
+    size_t anchor = 0;
+    size_t i = 0;
+    while(i + minMatch <= size) {
+        uint32_t sequence = read32(i);
+        uint32_t hash = (sequence * 2654435761u) >> 18;
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(i + 1);
+
+        if(candidate == 0 || i - (candidate - 1) > maxOffset || read32(candidate - 1) != sequence) {
+            ++i;
+            continue;
+        }
+        --candidate;
+
+        size_t matchLength = minMatch;
+        while(i + matchLength < size && data[candidate + matchLength] == data[i + matchLength]) ++matchLength;
+
+        size_t offset = i - candidate;
+        writeLiterals(anchor, i - anchor, static_cast<uint8_t>(std::min<size_t>(matchLength - minMatch, 15)));
+        result.push_back(static_cast<uint8_t>(offset & 0xFF));
+        result.push_back(static_cast<uint8_t>(offset >> 8));
+        if(matchLength - minMatch >= 15) writeLength(matchLength - minMatch - 15);
+
+        i += matchLength;
+        anchor = i;
+    }
+
+    // Last sequence is literals only
+    writeLiterals(anchor, size - anchor, 0);
+    return result;
+}
+
+/**
+ * Decompresses a block produced by Codec::compress
+ * @param data Pointer to the compressed bytes
+ * @param size Number of compressed bytes
+ * @param rawSize Expected size of the decompressed block
+ * @returns Decompressed bytes
+ * @throws std::runtime_error If `rawSize` is larger than `size` bytes can expand to
+ * @throws std::runtime_error If the block is truncated or malformed
+ * @throws std::runtime_error If the decompressed size differs from `rawSize`
+ */
+std::vector<uint8_t> xbl::Codec::decompress(const uint8_t* data, size_t size, size_t rawSize) {
+    // A compressed byte expands to at most 255 raw bytes, so larger sizes are corrupt
+    if(rawSize > (uint64_t)size * 255 + 15) ERROR("Raw size exceeds codec expansion: " + std::to_string(rawSize));
+
+    std::vector<uint8_t> result;
+    result.reserve(rawSize); // matches copy from `result`, so it must never reallocate
+
+    size_t i = 0;
+    auto readLength = [&](size_t length) {
+        uint8_t byte;
+        do {
+            if(i >= size) ERROR("Unexpected EOF while reading length");
+            byte = data[i++];
+            length += byte;
+        } while(byte == 255);
+        return length;
+    };
+
+    while(i < size) {
+        uint8_t token = data[i++];
+
+        // Literals
+        size_t literalLength = token >> 4;
+        if(literalLength == 15) literalLength = readLength(literalLength);
+        if(literalLength > size - i) ERROR("Unexpected EOF while copying literals");
+        if(result.size() + literalLength > rawSize) ERROR("Decompressed data exceeds raw size");
+        result.insert(result.end(), data + i, data + i + literalLength);
+        i += literalLength;
+        if(i == size) break;
+
+        // Match
+        if(size - i < 2) ERROR("Unexpected EOF while reading match offset");
+        size_t offset = data[i] | (data[i + 1] << 8);
+        i += 2;
+        size_t matchLength = token & 0x0F;
+        if(matchLength == 15) matchLength = readLength(matchLength);
+        matchLength += 4;
+
+        if(offset == 0 || offset > result.size()) ERROR("Invalid match offset: " + std::to_string(offset));
+        if(result.size() + matchLength > rawSize) ERROR("Decompressed data exceeds raw size");
+        size_t from = result.size() - offset;
+        for(size_t j = 0; j < matchLength; j++) {
+            result.push_back(result[from + j]); // byte-wise, matches may overlap
+        }
+    }
+
+    if(result.size() != rawSize) ERROR("Decompressed size mismatch: " + std::to_string(result.size()));
+    return result;
+}